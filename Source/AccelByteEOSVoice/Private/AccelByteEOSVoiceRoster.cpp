@@ -0,0 +1,193 @@
+// Copyright (c) 2026 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteEOSVoiceRoster.h"
+
+int32 FAccelByteEOSVoiceRoster::AddToChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    const uint32 ChannelMask = ToChannelMask(ChannelType);
+
+    if (const int32* ExistingIndex = PuidToIndex.Find(Puid))
+    {
+        if ((ChannelMasks[*ExistingIndex] & ChannelMask) == 0)
+        {
+            ChannelMasks[*ExistingIndex] |= ChannelMask;
+            ++Version;
+        }
+        return *ExistingIndex;
+    }
+
+    const int32 Index = Puids.Add(Puid);
+    UserIds.AddDefaulted();
+    DisplayNames.AddDefaulted();
+    ChannelMasks.Add(ChannelMask);
+    PuidToIndex.Add(Puid, Index);
+    ++Version;
+
+    return Index;
+}
+
+void FAccelByteEOSVoiceRoster::RemoveFromChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    const int32 Index = FindByPuid(Puid);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    const uint32 ChannelMask = ToChannelMask(ChannelType);
+    if ((ChannelMasks[Index] & ChannelMask) == 0)
+    {
+        return;
+    }
+
+    ChannelMasks[Index] &= ~ChannelMask;
+    if (ChannelMasks[Index] == 0)
+    {
+        RemoveAtSwap(Index);
+    }
+    ++Version;
+}
+
+void FAccelByteEOSVoiceRoster::RemoveChannel(EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    const uint32 ChannelMask = ToChannelMask(ChannelType);
+    bool bIsChanged = false;
+
+    // Iterate backward so swapped-in entries have already been visited
+    for (int32 Index = ChannelMasks.Num() - 1; Index >= 0; --Index)
+    {
+        if ((ChannelMasks[Index] & ChannelMask) == 0)
+        {
+            continue;
+        }
+
+        ChannelMasks[Index] &= ~ChannelMask;
+        if (ChannelMasks[Index] == 0)
+        {
+            RemoveAtSwap(Index);
+        }
+        bIsChanged = true;
+    }
+
+    if (bIsChanged)
+    {
+        ++Version;
+    }
+}
+
+bool FAccelByteEOSVoiceRoster::SetUserInfo(const FString& Puid, const FString& UserId, const FString& DisplayName)
+{
+    const int32 Index = FindByPuid(Puid);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    if (UserIds[Index].Equals(UserId) && DisplayNames[Index].Equals(DisplayName))
+    {
+        return true;
+    }
+
+    if (!UserIds[Index].IsEmpty())
+    {
+        UserIdToIndex.Remove(UserIds[Index]);
+    }
+    if (!UserId.IsEmpty())
+    {
+        UserIdToIndex.Add(UserId, Index);
+    }
+
+    UserIds[Index] = UserId;
+    DisplayNames[Index] = DisplayName;
+    ++Version;
+
+    return true;
+}
+
+void FAccelByteEOSVoiceRoster::Reset()
+{
+    if (Puids.Num() == 0)
+    {
+        return;
+    }
+
+    Puids.Reset();
+    UserIds.Reset();
+    DisplayNames.Reset();
+    ChannelMasks.Reset();
+    PuidToIndex.Reset();
+    UserIdToIndex.Reset();
+    ++Version;
+}
+
+int32 FAccelByteEOSVoiceRoster::FindByPuid(const FString& Puid) const
+{
+    const int32* Index = PuidToIndex.Find(Puid);
+    return Index != nullptr ? *Index : INDEX_NONE;
+}
+
+int32 FAccelByteEOSVoiceRoster::FindByUserId(const FString& UserId) const
+{
+    const int32* Index = UserIdToIndex.Find(UserId);
+    return Index != nullptr ? *Index : INDEX_NONE;
+}
+
+bool FAccelByteEOSVoiceRoster::IsInChannel(int32 Index, EAccelByteEOSVoiceVoiceChannelType ChannelType) const
+{
+    return ChannelMasks.IsValidIndex(Index) && (ChannelMasks[Index] & ToChannelMask(ChannelType)) != 0;
+}
+
+bool FAccelByteEOSVoiceRoster::IsInChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType) const
+{
+    return IsInChannel(FindByPuid(Puid), ChannelType);
+}
+
+TSharedRef<const FAccelByteEOSVoiceRosterSnapshot> FAccelByteEOSVoiceRoster::GetSnapshot() const
+{
+    if (!CachedSnapshot.IsValid() || CachedSnapshot->Version != Version)
+    {
+        TSharedRef<FAccelByteEOSVoiceRosterSnapshot> Snapshot = MakeShared<FAccelByteEOSVoiceRosterSnapshot>();
+        Snapshot->Version = Version;
+        Snapshot->Puids = Puids;
+        Snapshot->UserIds = UserIds;
+        Snapshot->DisplayNames = DisplayNames;
+        Snapshot->ChannelMasks = ChannelMasks;
+        CachedSnapshot = Snapshot;
+    }
+
+    return CachedSnapshot.ToSharedRef();
+}
+
+uint32 FAccelByteEOSVoiceRoster::ToChannelMask(EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    const uint32 Bit = static_cast<uint32>(ChannelType);
+    check(Bit < 32);
+    return 1u << Bit;
+}
+
+void FAccelByteEOSVoiceRoster::RemoveAtSwap(int32 Index)
+{
+    PuidToIndex.Remove(Puids[Index]);
+    if (!UserIds[Index].IsEmpty())
+    {
+        UserIdToIndex.Remove(UserIds[Index]);
+    }
+
+    const int32 LastIndex = Puids.Num() - 1;
+    if (Index != LastIndex)
+    {
+        // The last entry moves into the freed slot, point its lookups to the new index
+        PuidToIndex.Add(Puids[LastIndex], Index);
+        if (!UserIds[LastIndex].IsEmpty())
+        {
+            UserIdToIndex.Add(UserIds[LastIndex], Index);
+        }
+    }
+
+    Puids.RemoveAtSwap(Index);
+    UserIds.RemoveAtSwap(Index);
+    DisplayNames.RemoveAtSwap(Index);
+    ChannelMasks.RemoveAtSwap(Index);
+}
@@ -12,8 +12,44 @@
 #include "TimerManager.h"
 #include "IEOSSDKManager.h"
 #include "eos_rtc.h"
+#include "eos_connect.h"
 
 #define EOS_VOICE_TOPIC TEXT("EOS_VOICE")
+#define EOS_VOICE_USER_INFO_QUERY_MAX_IDS 128
+#define EOS_VOICE_USER_INFO_QUERY_MAX_ATTEMPTS 3
+#define EOS_VOICE_USER_INFO_QUERY_RETRY_DELAY 5.0f
+
+static FString ProductUserIdToString(EOS_ProductUserId ProductUserId)
+{
+    char Buffer[EOS_PRODUCTUSERID_MAX_LENGTH + 1] = {};
+    int32_t BufferLength = sizeof(Buffer);
+    if (EOS_ProductUserId_ToString(ProductUserId, Buffer, &BufferLength) != EOS_EResult::EOS_Success)
+    {
+        return FString();
+    }
+    return FString(UTF8_TO_TCHAR(Buffer));
+}
+
+struct FEOSQueryParticipantUserInfoContext
+{
+    TWeakObjectPtr<UAccelByteEOSVoiceSubsystem> Owner;
+    TArray<FString> Puids;
+
+    static void EOS_CALL Trampoline(const EOS_Connect_QueryProductUserIdMappingsCallbackInfo* Data)
+    {
+        if (!EOS_EResult_IsOperationComplete(Data->ResultCode))
+        {
+            return;
+        }
+
+        auto* Self = static_cast<FEOSQueryParticipantUserInfoContext*>(Data->ClientData);
+        if (Self->Owner.IsValid())
+        {
+            Self->Owner->OnQueryParticipantUserInfoCompleted(Self->Puids, Data->ResultCode);
+        }
+        delete Self;
+    }
+};
 
 void UAccelByteEOSVoiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -33,10 +69,15 @@ void UAccelByteEOSVoiceSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 
     IEOSPlatformHandlePtr PlatformHandle = EOSSubsystem->GetEOSPlatformHandle();
     EOSRtcHandle = EOS_Platform_GetRTCInterface(*PlatformHandle);
+    EOSConnectHandle = EOS_Platform_GetConnectInterface(*PlatformHandle);
 
     IdentityEOS = EOSSubsystem->GetIdentityInterface();
     check(IdentityEOS);
 
+    const UAccelByteEOSVoiceConfig* VoiceConfig = GetDefault<UAccelByteEOSVoiceConfig>();
+    check(VoiceConfig);
+    WorkScheduler.Start(VoiceConfig->VoiceWorkFrameBudgetMs);
+
     if (!IsRunningDedicatedServer())
     {
         IdentityAccelByte->AddOnLoginCompleteDelegate_Handle(0, FOnLoginCompleteDelegate::CreateUObject(this, &UAccelByteEOSVoiceSubsystem::OnAccelByteLoginCompleted));
@@ -56,6 +97,7 @@ void UAccelByteEOSVoiceSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 void UAccelByteEOSVoiceSubsystem::Deinitialize()
 {
     bIsShuttingDown = true;
+    WorkScheduler.Stop();
 
     if (VoiceChatUser != nullptr) 
     {
@@ -67,15 +109,65 @@ void UAccelByteEOSVoiceSubsystem::Deinitialize()
         }
         VoiceChatUser = nullptr;
     }
+    RemoveEOSNotifies();
+    if (UserInfoQueryTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(UserInfoQueryTickerHandle);
+        UserInfoQueryTickerHandle.Reset();
+    }
+    PendingUserInfoPuids.Reset();
+    InFlightUserInfoPuids.Reset();
+    UserInfoQueryAttempts.Reset();
+    Roster.Reset();
 
     Super::Deinitialize();
 }
 
+void UAccelByteEOSVoiceSubsystem::RemoveEOSNotifies()
+{
+    if (EOSRtcHandle == nullptr)
+    {
+        return;
+    }
+
+    // Notify client data points into this object, it must not outlive the subsystem
+    for (EOS_NotificationId* NotifyId : { &EOSPartyVoiceDisconnectNotify.Id, &EOSTeamVoiceDisconnectNotify.Id, &EOSSessionVoiceDisconnectNotify.Id })
+    {
+        if (*NotifyId != EOS_INVALID_NOTIFICATIONID)
+        {
+            EOS_RTC_RemoveNotifyDisconnected(EOSRtcHandle, *NotifyId);
+            *NotifyId = EOS_INVALID_NOTIFICATIONID;
+        }
+    }
+    for (EOS_NotificationId* NotifyId : { &EOSPartyVoiceParticipantStatusNotify.Id, &EOSTeamVoiceParticipantStatusNotify.Id, &EOSSessionVoiceParticipantStatusNotify.Id })
+    {
+        if (*NotifyId != EOS_INVALID_NOTIFICATIONID)
+        {
+            EOS_RTC_RemoveNotifyParticipantStatusChanged(EOSRtcHandle, *NotifyId);
+            *NotifyId = EOS_INVALID_NOTIFICATIONID;
+        }
+    }
+}
+
 void UAccelByteEOSVoiceSubsystem::SetPlayerMuted(const FString& PlayerName, bool bIsMuted)
 {
     VoiceChatUser->SetPlayerMuted(PlayerName, bIsMuted);
 }
 
+bool UAccelByteEOSVoiceSubsystem::SetPlayerMutedByUserId(const FString& UserId, bool bIsMuted)
+{
+    const int32 Index = Roster.FindByUserId(UserId);
+    if (Index == INDEX_NONE)
+    {
+        ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("User %s is not in the voice roster. Abort to set player muted"), *UserId);
+        return false;
+    }
+
+    // EOS voice chat identifies players by their PUID
+    SetPlayerMuted(Roster.GetPuid(Index), bIsMuted);
+    return true;
+}
+
 void UAccelByteEOSVoiceSubsystem::SetAudioInputDeviceMuted(bool bIsMuted)
 {
     VoiceChatUser->SetAudioInputDeviceMuted(bIsMuted);
@@ -101,6 +193,8 @@ void UAccelByteEOSVoiceSubsystem::TransmitToSpecificChannel(EAccelByteEOSVoiceVo
 
 void UAccelByteEOSVoiceSubsystem::HandlePartyVoiceDisconnection(const EOS_RTC_DisconnectedCallbackInfo& Data)
 {
+    Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::PARTY);
+
     // make sure retryable
     bool bShouldReconnect = Data.ResultCode == EOS_EResult::EOS_NoConnection ||
         Data.ResultCode == EOS_EResult::EOS_ServiceFailure ||
@@ -113,18 +207,20 @@ void UAccelByteEOSVoiceSubsystem::HandlePartyVoiceDisconnection(const EOS_RTC_Di
 
     FString RoomName = StringCast<TCHAR>(Data.RoomName).Get();
     FString ExpectedRoomName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::PARTY);
-    if (RoomName.Equals(ExpectedRoomName))
+    if (!RoomName.Equals(ExpectedRoomName))
     {
         ACCELBYTE_EOS_VOICE_LOG(Error, TEXT("Failed to reconnect! RoomName check failed! %s != %s"), *RoomName, *ExpectedRoomName);
         return;
     }
 
     // TODO: Add proper retry, this only one shot retry.
-    RequestVoiceToken(EAccelByteEOSVoiceVoiceChannelType::PARTY);
+    EnqueueVoiceTokenRefresh(EAccelByteEOSVoiceVoiceChannelType::PARTY);
 }
 
 void UAccelByteEOSVoiceSubsystem::HandleTeamVoiceDisconnection(const EOS_RTC_DisconnectedCallbackInfo& Data)
 {
+    Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::TEAM);
+
     // make sure retryable
     bool bShouldReconnect = Data.ResultCode == EOS_EResult::EOS_NoConnection ||
         Data.ResultCode == EOS_EResult::EOS_ServiceFailure ||
@@ -137,16 +233,18 @@ void UAccelByteEOSVoiceSubsystem::HandleTeamVoiceDisconnection(const EOS_RTC_Dis
 
     FString RoomName = StringCast<TCHAR>(Data.RoomName).Get();
     FString ExpectedRoomName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::TEAM);
-    if (RoomName.Equals(ExpectedRoomName))
+    if (!RoomName.Equals(ExpectedRoomName))
     {
         ACCELBYTE_EOS_VOICE_LOG(Error, TEXT("Failed to reconnect! RoomName check failed! %s != %s"), *RoomName, *ExpectedRoomName);
         return;
     }
-    RequestVoiceToken(EAccelByteEOSVoiceVoiceChannelType::TEAM);
+    EnqueueVoiceTokenRefresh(EAccelByteEOSVoiceVoiceChannelType::TEAM);
 }
 
 void UAccelByteEOSVoiceSubsystem::HandleSessionVoiceDisconnection(const EOS_RTC_DisconnectedCallbackInfo& Data)
 {
+    Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::SESSION);
+
     // make sure retryable
     bool bShouldReconnect = Data.ResultCode == EOS_EResult::EOS_NoConnection ||
         Data.ResultCode == EOS_EResult::EOS_ServiceFailure ||
@@ -159,12 +257,253 @@ void UAccelByteEOSVoiceSubsystem::HandleSessionVoiceDisconnection(const EOS_RTC_
 
     FString RoomName = StringCast<TCHAR>(Data.RoomName).Get();
     FString ExpectedRoomName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::SESSION);
-    if (RoomName.Equals(ExpectedRoomName))
+    if (!RoomName.Equals(ExpectedRoomName))
     {
         ACCELBYTE_EOS_VOICE_LOG(Error, TEXT("Failed to reconnect! RoomName check failed! %s != %s"), *RoomName, *ExpectedRoomName);
         return;
     }
-    RequestVoiceToken(EAccelByteEOSVoiceVoiceChannelType::SESSION);
+    EnqueueVoiceTokenRefresh(EAccelByteEOSVoiceVoiceChannelType::SESSION);
+}
+
+void UAccelByteEOSVoiceSubsystem::HandlePartyVoiceParticipantStatusChanged(const EOS_RTC_ParticipantStatusChangedCallbackInfo& Data)
+{
+    HandleParticipantStatusChanged(EAccelByteEOSVoiceVoiceChannelType::PARTY, Data);
+}
+
+void UAccelByteEOSVoiceSubsystem::HandleTeamVoiceParticipantStatusChanged(const EOS_RTC_ParticipantStatusChangedCallbackInfo& Data)
+{
+    HandleParticipantStatusChanged(EAccelByteEOSVoiceVoiceChannelType::TEAM, Data);
+}
+
+void UAccelByteEOSVoiceSubsystem::HandleSessionVoiceParticipantStatusChanged(const EOS_RTC_ParticipantStatusChangedCallbackInfo& Data)
+{
+    HandleParticipantStatusChanged(EAccelByteEOSVoiceVoiceChannelType::SESSION, Data);
+}
+
+void UAccelByteEOSVoiceSubsystem::HandleParticipantStatusChanged(EAccelByteEOSVoiceVoiceChannelType ChannelType, const EOS_RTC_ParticipantStatusChangedCallbackInfo& Data)
+{
+    const FString Puid = ProductUserIdToString(Data.ParticipantId);
+    if (Puid.IsEmpty())
+    {
+        ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("Invalid participant id on channel %s"), *ToChannelName(ChannelType));
+        return;
+    }
+
+    // Roster updates are cheap, only the EOS Connect query is deferred
+    if (Data.ParticipantStatus == EOS_ERTCParticipantStatus::EOS_RTCPS_Left)
+    {
+        Roster.RemoveFromChannel(Puid, ChannelType);
+        if (Roster.FindByPuid(Puid) == INDEX_NONE)
+        {
+            // A later rejoin starts the user info lookup over
+            UserInfoQueryAttempts.Remove(Puid);
+        }
+        return;
+    }
+
+    const int32 Index = Roster.AddToChannel(Puid, ChannelType);
+    if (Roster.GetUserId(Index).IsEmpty())
+    {
+        RequestParticipantUserInfo(Puid);
+    }
+}
+
+void UAccelByteEOSVoiceSubsystem::RegisterParticipantStatusNotify(EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    EOS_NotificationId* NotifyId = nullptr;
+    void* ClientData = nullptr;
+    EOS_RTC_OnParticipantStatusChangedCallback Callback = nullptr;
+
+    switch (ChannelType)
+    {
+    case EAccelByteEOSVoiceVoiceChannelType::PARTY:
+        EOSPartyVoiceParticipantStatusNotify.Owner = this;
+        NotifyId = &EOSPartyVoiceParticipantStatusNotify.Id;
+        ClientData = &EOSPartyVoiceParticipantStatusNotify;
+        Callback = &UAccelByteEOSVoiceSubsystem::FEOSPartyVoiceParticipantStatusNotify::Trampoline;
+        break;
+    case EAccelByteEOSVoiceVoiceChannelType::TEAM:
+        EOSTeamVoiceParticipantStatusNotify.Owner = this;
+        NotifyId = &EOSTeamVoiceParticipantStatusNotify.Id;
+        ClientData = &EOSTeamVoiceParticipantStatusNotify;
+        Callback = &UAccelByteEOSVoiceSubsystem::FEOSTeamVoiceParticipantStatusNotify::Trampoline;
+        break;
+    case EAccelByteEOSVoiceVoiceChannelType::SESSION:
+        EOSSessionVoiceParticipantStatusNotify.Owner = this;
+        NotifyId = &EOSSessionVoiceParticipantStatusNotify.Id;
+        ClientData = &EOSSessionVoiceParticipantStatusNotify;
+        Callback = &UAccelByteEOSVoiceSubsystem::FEOSSessionVoiceParticipantStatusNotify::Trampoline;
+        break;
+    default:
+        return;
+    }
+
+    if (*NotifyId != EOS_INVALID_NOTIFICATIONID)
+    {
+        return;
+    }
+
+    const FTCHARToUTF8 Utf8RoomName(*ToChannelName(ChannelType));
+    const FTCHARToUTF8 ProductIdUtf8(*EpicPUID);
+
+    EOS_RTC_AddNotifyParticipantStatusChangedOptions ParticipantStatusOptions = {};
+    ParticipantStatusOptions.ApiVersion = EOS_RTC_ADDNOTIFYPARTICIPANTSTATUSCHANGED_API_LATEST;
+    ParticipantStatusOptions.RoomName = Utf8RoomName.Get();
+    ParticipantStatusOptions.LocalUserId = EOS_ProductUserId_FromString(ProductIdUtf8.Get());
+
+    *NotifyId = EOS_RTC_AddNotifyParticipantStatusChanged(EOSRtcHandle, &ParticipantStatusOptions, ClientData, Callback);
+    if (*NotifyId == EOS_INVALID_NOTIFICATIONID)
+    {
+        ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("EOS_RTC_AddNotifyParticipantStatusChanged failed Room Name: %s"), *ToChannelName(ChannelType));
+    }
+}
+
+void UAccelByteEOSVoiceSubsystem::RequestParticipantUserInfo(const FString& Puid)
+{
+    if (PendingUserInfoPuids.Contains(Puid) || InFlightUserInfoPuids.Contains(Puid))
+    {
+        return;
+    }
+
+    PendingUserInfoPuids.Add(Puid);
+    ScheduleParticipantUserInfoQuery(0.0f);
+}
+
+void UAccelByteEOSVoiceSubsystem::ScheduleParticipantUserInfoQuery(float Delay)
+{
+    if (UserInfoQueryTickerHandle.IsValid())
+    {
+        return;
+    }
+
+    // Requests arriving before the ticker fires are sent together in the same query
+    UserInfoQueryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAccelByteEOSVoiceSubsystem::FlushParticipantUserInfoQueries), Delay);
+}
+
+bool UAccelByteEOSVoiceSubsystem::FlushParticipantUserInfoQueries(float DeltaTime)
+{
+    UserInfoQueryTickerHandle.Reset();
+
+    if (bIsShuttingDown || PendingUserInfoPuids.Num() == 0)
+    {
+        return false;
+    }
+
+    TArray<FString> Puids;
+    Puids.Reserve(PendingUserInfoPuids.Num());
+    for (const FString& Puid : PendingUserInfoPuids)
+    {
+        // Skip participants that left or got resolved while waiting
+        const int32 Index = Roster.FindByPuid(Puid);
+        if (Index != INDEX_NONE && Roster.GetUserId(Index).IsEmpty())
+        {
+            Puids.Add(Puid);
+        }
+        else
+        {
+            UserInfoQueryAttempts.Remove(Puid);
+        }
+    }
+    PendingUserInfoPuids.Reset();
+
+    for (int32 BatchStart = 0; BatchStart < Puids.Num(); BatchStart += EOS_VOICE_USER_INFO_QUERY_MAX_IDS)
+    {
+        const int32 BatchCount = FMath::Min(EOS_VOICE_USER_INFO_QUERY_MAX_IDS, Puids.Num() - BatchStart);
+        TArray<FString> BatchPuids(Puids.GetData() + BatchStart, BatchCount);
+        QueryParticipantUserInfo(MoveTemp(BatchPuids));
+    }
+
+    return false;
+}
+
+void UAccelByteEOSVoiceSubsystem::QueryParticipantUserInfo(TArray<FString>&& Puids)
+{
+    const FTCHARToUTF8 ProductIdUtf8(*EpicPUID);
+
+    TArray<EOS_ProductUserId> ParticipantIds;
+    ParticipantIds.Reserve(Puids.Num());
+    for (const FString& Puid : Puids)
+    {
+        const FTCHARToUTF8 ParticipantIdUtf8(*Puid);
+        ParticipantIds.Add(EOS_ProductUserId_FromString(ParticipantIdUtf8.Get()));
+        InFlightUserInfoPuids.Add(Puid);
+    }
+
+    // With EOS Connect OpenID, the external account id is the AccelByte user id
+    EOS_Connect_QueryProductUserIdMappingsOptions QueryOptions = {};
+    QueryOptions.ApiVersion = EOS_CONNECT_QUERYPRODUCTUSERIDMAPPINGS_API_LATEST;
+    QueryOptions.LocalUserId = EOS_ProductUserId_FromString(ProductIdUtf8.Get());
+    QueryOptions.ProductUserIds = ParticipantIds.GetData();
+    QueryOptions.ProductUserIdCount = static_cast<uint32_t>(ParticipantIds.Num());
+
+    FEOSQueryParticipantUserInfoContext* Context = new FEOSQueryParticipantUserInfoContext{ this, MoveTemp(Puids) };
+    EOS_Connect_QueryProductUserIdMappings(EOSConnectHandle, &QueryOptions, Context, &FEOSQueryParticipantUserInfoContext::Trampoline);
+}
+
+void UAccelByteEOSVoiceSubsystem::OnQueryParticipantUserInfoCompleted(const TArray<FString>& Puids, EOS_EResult Result)
+{
+    for (const FString& Puid : Puids)
+    {
+        InFlightUserInfoPuids.Remove(Puid);
+    }
+
+    if (Result != EOS_EResult::EOS_Success)
+    {
+        ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("Failed to query user info of %d participants: %s"), Puids.Num(), UTF8_TO_TCHAR(EOS_EResult_ToString(Result)));
+
+        bool bShouldRetry = false;
+        for (const FString& Puid : Puids)
+        {
+            if (Roster.FindByPuid(Puid) == INDEX_NONE)
+            {
+                UserInfoQueryAttempts.Remove(Puid);
+                continue;
+            }
+
+            int32& Attempts = UserInfoQueryAttempts.FindOrAdd(Puid);
+            if (++Attempts >= EOS_VOICE_USER_INFO_QUERY_MAX_ATTEMPTS)
+            {
+                // Stays unresolved until the participant joins a channel again, SetPlayerMutedByUserId can't find it meanwhile
+                ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("Giving up querying user info of participant %s"), *Puid);
+                UserInfoQueryAttempts.Remove(Puid);
+                continue;
+            }
+
+            PendingUserInfoPuids.Add(Puid);
+            bShouldRetry = true;
+        }
+
+        if (bShouldRetry)
+        {
+            ScheduleParticipantUserInfoQuery(EOS_VOICE_USER_INFO_QUERY_RETRY_DELAY);
+        }
+        return;
+    }
+
+    for (const FString& Puid : Puids)
+    {
+        UserInfoQueryAttempts.Remove(Puid);
+
+        const FTCHARToUTF8 Utf8Puid(*Puid);
+
+        EOS_Connect_CopyProductUserInfoOptions CopyOptions = {};
+        CopyOptions.ApiVersion = EOS_CONNECT_COPYPRODUCTUSERINFO_API_LATEST;
+        CopyOptions.TargetUserId = EOS_ProductUserId_FromString(Utf8Puid.Get());
+
+        EOS_Connect_ExternalAccountInfo* AccountInfo = nullptr;
+        if (EOS_Connect_CopyProductUserInfo(EOSConnectHandle, &CopyOptions, &AccountInfo) != EOS_EResult::EOS_Success || AccountInfo == nullptr)
+        {
+            ACCELBYTE_EOS_VOICE_LOG(Warning, TEXT("No external account info for participant %s"), *Puid);
+            continue;
+        }
+
+        // The participant may have left while the query was in flight, in that case there is nothing to update
+        const FString UserId = AccountInfo->AccountId != nullptr ? UTF8_TO_TCHAR(AccountInfo->AccountId) : TEXT("");
+        const FString DisplayName = AccountInfo->DisplayName != nullptr ? UTF8_TO_TCHAR(AccountInfo->DisplayName) : TEXT("");
+        Roster.SetUserInfo(Puid, UserId, DisplayName);
+        EOS_Connect_ExternalAccountInfo_Release(AccountInfo);
+    }
 }
 
 void UAccelByteEOSVoiceSubsystem::LoginToEpic(int32 LocalUserNum)
@@ -269,6 +608,22 @@ void UAccelByteEOSVoiceSubsystem::RequestVoiceToken(EAccelByteEOSVoiceVoiceChann
     }
 }
 
+void UAccelByteEOSVoiceSubsystem::EnqueueVoiceTokenRefresh(EAccelByteEOSVoiceVoiceChannelType ChannelType)
+{
+    ACCELBYTE_EOS_VOICE_LOG(Log, TEXT("Queue voice token refresh for channel %s"), *ToChannelName(ChannelType));
+
+    WorkScheduler.Enqueue(EAccelByteEOSVoiceWorkPriority::Normal, [this, ChannelType]()
+        {
+            // The session may have been left while the refresh was queued
+            if (!RoomIdMap.Contains(ChannelType))
+            {
+                ACCELBYTE_EOS_VOICE_LOG(Log, TEXT("Channel %s was left while queued. Abort to refresh voice token"), *ToChannelName(ChannelType));
+                return;
+            }
+            RequestVoiceToken(ChannelType);
+        });
+}
+
 void UAccelByteEOSVoiceSubsystem::JoinVoiceChannel(EAccelByteEOSVoiceVoiceChannelType ChannelName, const FString& RoomId, const FString& ChannelCredentials, EVoiceChatChannelType ChannelType)
 {
     if (VoiceChatUser == nullptr)
@@ -398,6 +753,8 @@ void UAccelByteEOSVoiceSubsystem::OnAccelByteDestroySessionCompleted(FName Sessi
     {
         const FString ChannelName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::PARTY);
         RoomIdMap.Remove(EAccelByteEOSVoiceVoiceChannelType::PARTY);
+        ++ChannelTokenGenerations.FindOrAdd(EAccelByteEOSVoiceVoiceChannelType::PARTY);
+        Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::PARTY);
         VoiceChatUser->LeaveChannel(ChannelName, {});
     }
     else if (SessionName.IsEqual(NAME_GameSession))
@@ -406,12 +763,16 @@ void UAccelByteEOSVoiceSubsystem::OnAccelByteDestroySessionCompleted(FName Sessi
         {
             const FString ChannelName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::TEAM);
             RoomIdMap.Remove(EAccelByteEOSVoiceVoiceChannelType::TEAM);
+            ++ChannelTokenGenerations.FindOrAdd(EAccelByteEOSVoiceVoiceChannelType::TEAM);
+            Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::TEAM);
             VoiceChatUser->LeaveChannel(ChannelName, {});
         }
         if (RoomIdMap.Contains(EAccelByteEOSVoiceVoiceChannelType::SESSION))
         {
             const FString ChannelName = ToChannelName(EAccelByteEOSVoiceVoiceChannelType::SESSION);
             RoomIdMap.Remove(EAccelByteEOSVoiceVoiceChannelType::SESSION);
+            ++ChannelTokenGenerations.FindOrAdd(EAccelByteEOSVoiceVoiceChannelType::SESSION);
+            Roster.RemoveChannel(EAccelByteEOSVoiceVoiceChannelType::SESSION);
             VoiceChatUser->LeaveChannel(ChannelName, {});
         }
     }
@@ -462,6 +823,22 @@ void UAccelByteEOSVoiceSubsystem::OnSessionVoiceTokenGenerated(const FAccelByteE
 
 void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerated(const FAccelByteEOSVoiceVoiceEOSTokenResponse& Response)
 {
+    // Record the channel right away, so leaving the session while the join is still queued invalidates it
+    RoomIdMap.Emplace(Response.ChannelType, Response.RoomId);
+    const uint32 Generation = ++ChannelTokenGenerations.FindOrAdd(Response.ChannelType);
+
+    // Tokens tend to arrive at match start while the level is loading, spread the joins across frames
+    WorkScheduler.Enqueue(EAccelByteEOSVoiceWorkPriority::High, [this, Response, Generation]() { ProcessVoiceToken(Response, Generation); });
+}
+
+void UAccelByteEOSVoiceSubsystem::ProcessVoiceToken(const FAccelByteEOSVoiceVoiceEOSTokenResponse& Response, uint32 Generation)
+{
+    if (ChannelTokenGenerations.FindRef(Response.ChannelType) != Generation)
+    {
+        ACCELBYTE_EOS_VOICE_LOG(Log, TEXT("Channel %s was left or received a newer token while queued. Abort to join voice channel"), *ToChannelName(Response.ChannelType));
+        return;
+    }
+
     FEOSVoiceChatChannelCredentials Credentials;
     Credentials.ClientBaseUrl = Response.ClientBaseUrl;
     Credentials.ParticipantToken = Response.Token;
@@ -476,11 +853,10 @@ void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerated(const FAccelByteEOSVoice
 
     if (Response.ChannelType == EAccelByteEOSVoiceVoiceChannelType::PARTY)
     {
-        RoomIdMap.Emplace(EAccelByteEOSVoiceVoiceChannelType::PARTY, Response.RoomId);
-
-        if (EOSPartyVoiceDisconnectNotify.Id == 0)
+        if (EOSPartyVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
         {
             // Register disconnect event
+            EOSPartyVoiceDisconnectNotify.Owner = this;
             EOSPartyVoiceDisconnectNotify.Id = EOS_RTC_AddNotifyDisconnected(EOSRtcHandle, &DisconnectedOptions, &EOSPartyVoiceDisconnectNotify, &UAccelByteEOSVoiceSubsystem::FEOSPartyVoiceDisconnectNotify::Trampoline);
             if (EOSPartyVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
             {
@@ -490,11 +866,10 @@ void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerated(const FAccelByteEOSVoice
     }
     else if (Response.ChannelType == EAccelByteEOSVoiceVoiceChannelType::TEAM)
     {
-        RoomIdMap.Emplace(EAccelByteEOSVoiceVoiceChannelType::TEAM, Response.RoomId);
-
-        if (EOSTeamVoiceDisconnectNotify.Id == 0)
+        if (EOSTeamVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
         {
             // Register disconnect event
+            EOSTeamVoiceDisconnectNotify.Owner = this;
             EOSTeamVoiceDisconnectNotify.Id = EOS_RTC_AddNotifyDisconnected(EOSRtcHandle, &DisconnectedOptions, &EOSTeamVoiceDisconnectNotify, &UAccelByteEOSVoiceSubsystem::FEOSTeamVoiceDisconnectNotify::Trampoline);
             if (EOSTeamVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
             {
@@ -504,11 +879,10 @@ void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerated(const FAccelByteEOSVoice
     }
     else if (Response.ChannelType == EAccelByteEOSVoiceVoiceChannelType::SESSION)
     {
-        RoomIdMap.Emplace(EAccelByteEOSVoiceVoiceChannelType::SESSION, Response.RoomId);
-
-        if (EOSSessionVoiceDisconnectNotify.Id == 0)
+        if (EOSSessionVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
         {
             // Register disconnect event
+            EOSSessionVoiceDisconnectNotify.Owner = this;
             EOSSessionVoiceDisconnectNotify.Id = EOS_RTC_AddNotifyDisconnected(EOSRtcHandle, &DisconnectedOptions, &EOSSessionVoiceDisconnectNotify, &UAccelByteEOSVoiceSubsystem::FEOSSessionVoiceDisconnectNotify::Trampoline);
             if (EOSSessionVoiceDisconnectNotify.Id == EOS_INVALID_NOTIFICATIONID)
             {
@@ -517,6 +891,7 @@ void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerated(const FAccelByteEOSVoice
         }
     }
 
+    RegisterParticipantStatusNotify(Response.ChannelType);
     JoinVoiceChannel(Response.ChannelType, Response.RoomId, Credentials.ToJson(), EVoiceChatChannelType::NonPositional);
 }
 
@@ -527,3 +902,6 @@ void UAccelByteEOSVoiceSubsystem::OnVoiceTokenGenerationFailedForChannel(int32 E
 }
 
 #undef EOS_VOICE_TOPIC
+#undef EOS_VOICE_USER_INFO_QUERY_MAX_IDS
+#undef EOS_VOICE_USER_INFO_QUERY_MAX_ATTEMPTS
+#undef EOS_VOICE_USER_INFO_QUERY_RETRY_DELAY
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteEOSVoiceWorkScheduler.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+FAccelByteEOSVoiceWorkScheduler::~FAccelByteEOSVoiceWorkScheduler()
+{
+    Stop();
+}
+
+void FAccelByteEOSVoiceWorkScheduler::Start(float InFrameBudgetMs)
+{
+    bIsStopped = false;
+    Stats = FAccelByteEOSVoiceWorkSchedulerStats();
+    FrameBudgetSeconds = InFrameBudgetMs / 1000.0;
+    if (FrameBudgetSeconds > 0.0 && !TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAccelByteEOSVoiceWorkScheduler::Tick));
+    }
+}
+
+void FAccelByteEOSVoiceWorkScheduler::Stop()
+{
+    bIsStopped = true;
+
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    for (TQueue<TUniqueFunction<void()>>& Queue : Queues)
+    {
+        Queue.Empty();
+    }
+    for (int32& QueueDepth : Stats.QueueDepth)
+    {
+        QueueDepth = 0;
+    }
+}
+
+void FAccelByteEOSVoiceWorkScheduler::Enqueue(EAccelByteEOSVoiceWorkPriority Priority, TUniqueFunction<void()>&& Work)
+{
+    check(Priority < EAccelByteEOSVoiceWorkPriority::Count);
+
+    if (bIsStopped)
+    {
+        return;
+    }
+
+    if (!TickerHandle.IsValid())
+    {
+        Work();
+        return;
+    }
+
+    const uint8 PriorityIndex = static_cast<uint8>(Priority);
+    Queues[PriorityIndex].Enqueue(MoveTemp(Work));
+    Stats.QueueDepth[PriorityIndex]++;
+    Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, GetQueueDepth());
+}
+
+int32 FAccelByteEOSVoiceWorkScheduler::GetQueueDepth() const
+{
+    int32 TotalQueueDepth = 0;
+    for (const int32 QueueDepth : Stats.QueueDepth)
+    {
+        TotalQueueDepth += QueueDepth;
+    }
+    return TotalQueueDepth;
+}
+
+bool FAccelByteEOSVoiceWorkScheduler::Tick(float DeltaTime)
+{
+    Stats.LastTickProcessedCount = 0;
+    Stats.LastTickTimeMs = 0.0;
+
+    if (GetQueueDepth() == 0)
+    {
+        return true;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(FAccelByteEOSVoiceWorkScheduler::Tick);
+
+    const double StartTime = FPlatformTime::Seconds();
+    double ElapsedTime = 0.0;
+
+    TUniqueFunction<void()> Work;
+    do
+    {
+        if (!DequeueNext(Work))
+        {
+            break;
+        }
+
+        Work();
+        Work.Reset();
+        Stats.LastTickProcessedCount++;
+        ElapsedTime = FPlatformTime::Seconds() - StartTime;
+    }
+    while (ElapsedTime < FrameBudgetSeconds);
+
+    Stats.LastTickTimeMs = ElapsedTime * 1000.0;
+    Stats.TotalTimeMs += Stats.LastTickTimeMs;
+    Stats.TotalProcessedCount += Stats.LastTickProcessedCount;
+
+    return true;
+}
+
+bool FAccelByteEOSVoiceWorkScheduler::DequeueNext(TUniqueFunction<void()>& OutWork)
+{
+    for (uint8 PriorityIndex = 0; PriorityIndex < static_cast<uint8>(EAccelByteEOSVoiceWorkPriority::Count); PriorityIndex++)
+    {
+        if (Queues[PriorityIndex].Dequeue(OutWork))
+        {
+            Stats.QueueDepth[PriorityIndex]--;
+            return true;
+        }
+    }
+    return false;
+}
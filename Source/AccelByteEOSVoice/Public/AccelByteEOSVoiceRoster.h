@@ -0,0 +1,75 @@
+// Copyright (c) 2026 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Api/AccelByteEOSVoiceApi.h"
+
+/** Immutable copy of the roster, safe to hold across frames (e.g. by scoreboard or voice HUD widgets) */
+struct ACCELBYTEEOSVOICE_API FAccelByteEOSVoiceRosterSnapshot
+{
+    /** Roster version this snapshot was taken from, compare against GetVersion() to detect changes */
+    uint32 Version{ 0 };
+    TArray<FString> Puids{};
+    TArray<FString> UserIds{};
+    TArray<FString> DisplayNames{};
+    TArray<uint32> ChannelMasks{};
+
+    int32 Num() const { return Puids.Num(); }
+};
+
+/**
+ * Participants of the joined voice rooms, keyed by EOS Product User Id (PUID).
+ * Entries are stored as parallel arrays, and a participant present in several rooms owns a single entry
+ * with one bit per channel type set in its channel mask.
+ * Only meant to be accessed from the game thread.
+ */
+class ACCELBYTEEOSVOICE_API FAccelByteEOSVoiceRoster
+{
+public:
+    /** Mark the participant as present in the channel, adding a new entry if needed. Returns the entry index */
+    int32 AddToChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    /** Clear the channel from the participant, the entry is removed once it is not in any channel anymore */
+    void RemoveFromChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    /** Clear the channel from every participant, used when the local user leaves the room */
+    void RemoveChannel(EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    /** Attach the AccelByte user id and display name to a known participant. Returns false if the PUID is unknown */
+    bool SetUserInfo(const FString& Puid, const FString& UserId, const FString& DisplayName);
+    void Reset();
+
+    int32 Num() const { return Puids.Num(); }
+    uint32 GetVersion() const { return Version; }
+
+    /** Returns INDEX_NONE if not found */
+    int32 FindByPuid(const FString& Puid) const;
+    /** Returns INDEX_NONE if not found or the user id has not been resolved yet */
+    int32 FindByUserId(const FString& UserId) const;
+    bool IsInChannel(int32 Index, EAccelByteEOSVoiceVoiceChannelType ChannelType) const;
+    bool IsInChannel(const FString& Puid, EAccelByteEOSVoiceVoiceChannelType ChannelType) const;
+
+    const FString& GetPuid(int32 Index) const { return Puids[Index]; }
+    const FString& GetUserId(int32 Index) const { return UserIds[Index]; }
+    const FString& GetDisplayName(int32 Index) const { return DisplayNames[Index]; }
+    uint32 GetChannelMask(int32 Index) const { return ChannelMasks[Index]; }
+
+    /** Returns the cached snapshot, only rebuilt when the roster changed since the last call */
+    TSharedRef<const FAccelByteEOSVoiceRosterSnapshot> GetSnapshot() const;
+
+    static uint32 ToChannelMask(EAccelByteEOSVoiceVoiceChannelType ChannelType);
+
+private:
+    void RemoveAtSwap(int32 Index);
+
+    TArray<FString> Puids{};
+    TArray<FString> UserIds{};
+    TArray<FString> DisplayNames{};
+    TArray<uint32> ChannelMasks{};
+
+    TMap<FString, int32> PuidToIndex{};
+    TMap<FString, int32> UserIdToIndex{};
+
+    uint32 Version{ 0 };
+    mutable TSharedPtr<const FAccelByteEOSVoiceRosterSnapshot> CachedSnapshot{};
+};
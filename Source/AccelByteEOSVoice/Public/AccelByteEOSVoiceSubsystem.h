@@ -14,6 +14,8 @@
 #include "IOnlineSubsystemEOS.h"
 #include "EOSVoiceChatUser.h"
 #include "TimerManager.h"
+#include "AccelByteEOSVoiceRoster.h"
+#include "AccelByteEOSVoiceWorkScheduler.h"
 #include "eos_sdk.h"
 #include "AccelByteEOSVoiceSubsystem.generated.h"
 
@@ -45,6 +47,8 @@ public:
     virtual void Deinitialize() override;
     void LoginToEpic(int32 LocalUserNum);
     void SetPlayerMuted(const FString& PlayerName, bool bIsMuted);
+    /** Mute a participant by AccelByte user id, resolved to the EOS player name through the roster */
+    bool SetPlayerMutedByUserId(const FString& UserId, bool bIsMuted);
     void SetAudioInputDeviceMuted(bool bIsMuted);
     void SetAudioOutputDeviceMuted(bool bIsMuted);
     void TransmitToSpecificChannel(EAccelByteEOSVoiceVoiceChannelType ChannelType);
@@ -52,15 +56,39 @@ public:
     IVoiceChatUser* GetVoiceChatUser() const { return VoiceChatUser; }
 	static FString ToChannelName(EAccelByteEOSVoiceVoiceChannelType ChannelName);
 
+    /** Participants of the joined voice rooms, maintained from EOS RTC participant status notifications */
+    const FAccelByteEOSVoiceRoster& GetRoster() const { return Roster; }
+    /** Cheap to call every frame, the snapshot is only rebuilt when the roster version changes */
+    TSharedRef<const FAccelByteEOSVoiceRosterSnapshot> GetRosterSnapshot() const { return Roster.GetSnapshot(); }
+    /** Time spent and queue depth of the deferred voice work */
+    const FAccelByteEOSVoiceWorkSchedulerStats& GetVoiceWorkStats() const { return WorkScheduler.GetStats(); }
+
 protected:
     bool GetGameSessionId(FName SessionName, FString& OutSessionId) const;
     void HandleAutoJoinVoiceChat(FName SessionName);
     void RequestVoiceToken(EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    /** Request a new token on the work scheduler after the channel got disconnected */
+    void EnqueueVoiceTokenRefresh(EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    void ProcessVoiceToken(const FAccelByteEOSVoiceVoiceEOSTokenResponse& Response, uint32 Generation);
     void JoinVoiceChannel(EAccelByteEOSVoiceVoiceChannelType ChannelName, const FString& RoomId, const FString& ChannelCredentials, EVoiceChatChannelType ChannelType);
 
     DEFINE_EOS_NOTIFY_STRUCT(EOSPartyVoiceDisconnectNotify, EOS_RTC_DisconnectedCallbackInfo, HandlePartyVoiceDisconnection);
     DEFINE_EOS_NOTIFY_STRUCT(EOSTeamVoiceDisconnectNotify, EOS_RTC_DisconnectedCallbackInfo, HandleTeamVoiceDisconnection);
     DEFINE_EOS_NOTIFY_STRUCT(EOSSessionVoiceDisconnectNotify, EOS_RTC_DisconnectedCallbackInfo, HandleSessionVoiceDisconnection);
+    DEFINE_EOS_NOTIFY_STRUCT(EOSPartyVoiceParticipantStatusNotify, EOS_RTC_ParticipantStatusChangedCallbackInfo, HandlePartyVoiceParticipantStatusChanged);
+    DEFINE_EOS_NOTIFY_STRUCT(EOSTeamVoiceParticipantStatusNotify, EOS_RTC_ParticipantStatusChangedCallbackInfo, HandleTeamVoiceParticipantStatusChanged);
+    DEFINE_EOS_NOTIFY_STRUCT(EOSSessionVoiceParticipantStatusNotify, EOS_RTC_ParticipantStatusChangedCallbackInfo, HandleSessionVoiceParticipantStatusChanged);
+
+    void HandleParticipantStatusChanged(EAccelByteEOSVoiceVoiceChannelType ChannelType, const EOS_RTC_ParticipantStatusChangedCallbackInfo& Data);
+    void RegisterParticipantStatusNotify(EAccelByteEOSVoiceVoiceChannelType ChannelType);
+    void RemoveEOSNotifies();
+    /** Queue the participant for the next batched EOS Connect query, no-op if already pending or in flight */
+    void RequestParticipantUserInfo(const FString& Puid);
+    void ScheduleParticipantUserInfoQuery(float Delay);
+    bool FlushParticipantUserInfoQueries(float DeltaTime);
+    void QueryParticipantUserInfo(TArray<FString>&& Puids);
+    void OnQueryParticipantUserInfoCompleted(const TArray<FString>& Puids, EOS_EResult Result);
+    friend struct FEOSQueryParticipantUserInfoContext;
 
 private:
     void OnAccelByteLoginCompleted(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error);
@@ -78,6 +106,14 @@ private:
     void OnVoiceTokenGenerationFailedForChannel(int32 ErrCode, const FString& ErrMsg, EAccelByteEOSVoiceVoiceChannelType ChannelType);
 
     TMap<EAccelByteEOSVoiceVoiceChannelType, FString> RoomIdMap{};
+    /** Bumped on every received token and on leaving the channel, a queued join with an older generation is dropped */
+    TMap<EAccelByteEOSVoiceVoiceChannelType, uint32> ChannelTokenGenerations{};
+    FAccelByteEOSVoiceRoster Roster{};
+    FAccelByteEOSVoiceWorkScheduler WorkScheduler{};
+    TSet<FString> PendingUserInfoPuids{};
+    TSet<FString> InFlightUserInfoPuids{};
+    TMap<FString, int32> UserInfoQueryAttempts{};
+    FTSTicker::FDelegateHandle UserInfoQueryTickerHandle{};
 
     FOnlineIdentityAccelBytePtr IdentityAccelByte;
     FOnlineSessionV2AccelBytePtr SessionAccelByte;
@@ -90,6 +126,7 @@ private:
     FString EpicPUID{};
     bool bIsShuttingDown{ false };
     EOS_HRTC EOSRtcHandle = nullptr;
+    EOS_HConnect EOSConnectHandle = nullptr;
 };
 
 UCLASS(Config = Engine, DefaultConfig)
@@ -117,6 +154,10 @@ public:
     bool bServerAutoGenerateSessionVoiceToken{ false };
     UPROPERTY(Config, EditAnywhere)
     bool bAutoGenerateDisplayNameIfEmpty{ false };
+    /** Per-frame time budget to process deferred voice work (channel joins and token refreshes).
+     * Set to 0 to process the work immediately when it arrives */
+    UPROPERTY(Config, EditAnywhere)
+    float VoiceWorkFrameBudgetMs{ 1.0f };
 };
 
 #undef DEFINE_EOS_NOTIFY_STRUCT
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+
+enum class EAccelByteEOSVoiceWorkPriority : uint8
+{
+    /** Channel joins, the player is waiting to hear others */
+    High,
+    /** Token refreshes */
+    Normal,
+    Count
+};
+
+struct ACCELBYTEEOSVOICE_API FAccelByteEOSVoiceWorkSchedulerStats
+{
+    /** Number of work items waiting, per priority */
+    int32 QueueDepth[static_cast<uint8>(EAccelByteEOSVoiceWorkPriority::Count)]{};
+    /** Highest total queue depth seen since the scheduler started */
+    int32 PeakQueueDepth{ 0 };
+    /** Number of work items executed during the last tick */
+    int32 LastTickProcessedCount{ 0 };
+    int64 TotalProcessedCount{ 0 };
+    double LastTickTimeMs{ 0.0 };
+    double TotalTimeMs{ 0.0 };
+};
+
+/**
+ * Defers non-urgent voice work to the core ticker and drains it within a per-frame time budget,
+ * higher priorities first and in enqueue order within the same priority.
+ * At least one item is executed per tick so the queue always makes progress.
+ * Only meant to be used from the game thread.
+ */
+class ACCELBYTEEOSVOICE_API FAccelByteEOSVoiceWorkScheduler
+{
+public:
+    ~FAccelByteEOSVoiceWorkScheduler();
+
+    /** Budget of zero or less disables deferring, enqueued work is executed immediately */
+    void Start(float InFrameBudgetMs);
+    /** Unregister from the ticker and drop all pending work, work enqueued afterward is dropped as well */
+    void Stop();
+
+    /** Executed immediately if the budget is zero or less, dropped if the scheduler is stopped */
+    void Enqueue(EAccelByteEOSVoiceWorkPriority Priority, TUniqueFunction<void()>&& Work);
+
+    int32 GetQueueDepth() const;
+    const FAccelByteEOSVoiceWorkSchedulerStats& GetStats() const { return Stats; }
+
+private:
+    bool Tick(float DeltaTime);
+    bool DequeueNext(TUniqueFunction<void()>& OutWork);
+
+    TQueue<TUniqueFunction<void()>> Queues[static_cast<uint8>(EAccelByteEOSVoiceWorkPriority::Count)];
+    FAccelByteEOSVoiceWorkSchedulerStats Stats{};
+    FTSTicker::FDelegateHandle TickerHandle{};
+    double FrameBudgetSeconds{ 0.0 };
+    bool bIsStopped{ false };
+};